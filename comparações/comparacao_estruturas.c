@@ -5,6 +5,7 @@
 #include <string.h>
 #include <assert.h>
 #include <inttypes.h>
+#include <pthread.h>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -26,6 +27,8 @@ int clock_gettime(int type, struct timespec *spec) {
 }
 
 #define CLOCK_MONOTONIC 1
+#else
+#include <unistd.h>
 #endif
 
 // ====================== Funções de temporização ==========================
@@ -33,6 +36,96 @@ static inline int64_t diff_nsec(struct timespec *start, struct timespec *end) {
     return (int64_t)(end->tv_sec - start->tv_sec) * 1000000000LL + (int64_t)(end->tv_nsec - start->tv_nsec);
 }
 
+// ====================== Histograma de latência ==========================
+// Histograma log-bucketed no estilo HDR: cada potência de 2 é dividida em
+// HIST_SUB sub-buckets lineares, com erro relativo de no máximo 1/HIST_SUB.
+// Valores abaixo de HIST_SUB ns são exatos. Registrar custa O(1) sem alocação.
+#define HIST_SUB_BITS 4
+#define HIST_SUB (1 << HIST_SUB_BITS)
+#define HIST_BUCKETS (64 * HIST_SUB)
+#define HIST_AMOSTRAGEM 1   // registra 1 a cada HIST_AMOSTRAGEM operações
+
+typedef struct {
+    int64_t counts[HIST_BUCKETS];
+    int64_t total;
+    int64_t max;
+} LatencyHist;
+
+static inline int hist_log2(uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(v);
+#else
+    int e = 0;
+    while (v >>= 1) e++;
+    return e;
+#endif
+}
+
+static inline int hist_index(int64_t v) {
+    if (v < HIST_SUB) return v < 0 ? 0 : (int)v;
+    int e = hist_log2((uint64_t)v);
+    int shift = e - HIST_SUB_BITS;
+    return (shift + 1) * HIST_SUB + (int)((v >> shift) - HIST_SUB);
+}
+
+// Maior valor que cai no bucket idx
+static int64_t hist_bucket_max(int idx) {
+    if (idx < HIST_SUB) return idx;
+    int shift = idx / HIST_SUB - 1;
+    int64_t base = (int64_t)(HIST_SUB + idx % HIST_SUB) << shift;
+    return base + ((int64_t)1 << shift) - 1;
+}
+
+void hist_reset(LatencyHist *h) {
+    memset(h, 0, sizeof(LatencyHist));
+}
+
+static inline void hist_record(LatencyHist *h, int64_t v) {
+    h->counts[hist_index(v)]++;
+    h->total++;
+    if (v > h->max) h->max = v;
+}
+
+// Latência abaixo da qual estão p (0..1) das amostras
+int64_t hist_percentile(const LatencyHist *h, double p) {
+    if (!h->total) return 0;
+    int64_t alvo = (int64_t)(p * (double)h->total + 0.999999);
+    if (alvo < 1) alvo = 1;
+    int64_t acumulado = 0;
+    for (int i = 0; i < HIST_BUCKETS; i++) {
+        acumulado += h->counts[i];
+        if (acumulado >= alvo) {
+            int64_t v = hist_bucket_max(i);
+            return v < h->max ? v : h->max;
+        }
+    }
+    return h->max;
+}
+
+void hist_print(const LatencyHist *h, const char *estrutura, const char *fase) {
+    printf("%s %s: p50=%" PRId64 " p90=%" PRId64 " p99=%" PRId64 " p99.9=%" PRId64 " max=%" PRId64 " ns\n",
+           estrutura, fase, hist_percentile(h, 0.50), hist_percentile(h, 0.90),
+           hist_percentile(h, 0.99), hist_percentile(h, 0.999), h->max);
+}
+
+// Uma linha por bucket não vazio, com a fração acumulada para traçar a CDF
+void hist_write_csv(const LatencyHist *h, FILE *csv, const char *estrutura, int N, const char *fase) {
+    int64_t acumulado = 0;
+    for (int i = 0; i < HIST_BUCKETS; i++) {
+        if (!h->counts[i]) continue;
+        acumulado += h->counts[i];
+        int64_t v = hist_bucket_max(i);
+        fprintf(csv, "%s,%d,%s,%" PRId64 ",%" PRId64 ",%.6f\n", estrutura, N, fase,
+                v < h->max ? v : h->max, h->counts[i], (double)acumulado / (double)h->total);
+    }
+}
+
+void hist_write_percentis(const LatencyHist *h, FILE *csv, const char *estrutura, int N, const char *fase) {
+    fprintf(csv, "%s,%d,%s,%" PRId64 ",%" PRId64 ",%" PRId64 ",%" PRId64 ",%" PRId64 "\n", estrutura, N, fase,
+            hist_percentile(h, 0.50), hist_percentile(h, 0.90), hist_percentile(h, 0.99),
+            hist_percentile(h, 0.999), h->max);
+}
+
 void shuffle_array(int *arr, size_t n) {
     for (size_t i = n - 1; i > 0; --i) {
         size_t j = (size_t)(rand() % (i + 1));
@@ -50,6 +143,139 @@ int* gera_vetor(int n) {
     return v;
 }
 
+int* gera_vetor_ordenado(int n) {
+    int *v = malloc(n * sizeof(int));
+    if (!v) exit(EXIT_FAILURE);
+    for (int i = 0; i < n; i++) v[i] = i + 1;
+    return v;
+}
+
+static int compara_int(const void *a, const void *b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// ====================== Pool de threads ==========================
+// Pool fixo para o dividir-e-conquistar das operações em lote. Uma tarefa é
+// publicada com pool_spawn e esperada com pool_wait; quem espera executa outras
+// tarefas da fila enquanto isso, então tarefas aninhadas nunca travam o pool.
+typedef struct PoolTask {
+    void (*fn)(void *arg);
+    void *arg;
+    int done;
+    struct PoolTask *next;
+} PoolTask;
+
+typedef struct {
+    pthread_t *threads;
+    int nthreads;
+    int par_depth;          // profundidade máxima da recursão que ainda gera tarefas
+    PoolTask *head;
+    pthread_mutex_t mtx;
+    pthread_cond_t cond;
+    int stop;
+} ThreadPool;
+
+static void pool_run(ThreadPool *pool, PoolTask *task) {
+    task->fn(task->arg);
+    pthread_mutex_lock(&pool->mtx);
+    task->done = 1;
+    pthread_cond_broadcast(&pool->cond);
+    pthread_mutex_unlock(&pool->mtx);
+}
+
+static void* pool_worker(void *arg) {
+    ThreadPool *pool = (ThreadPool*)arg;
+    pthread_mutex_lock(&pool->mtx);
+    while (!pool->stop) {
+        PoolTask *task = pool->head;
+        if (!task) {
+            pthread_cond_wait(&pool->cond, &pool->mtx);
+            continue;
+        }
+        pool->head = task->next;
+        pthread_mutex_unlock(&pool->mtx);
+        pool_run(pool, task);
+        pthread_mutex_lock(&pool->mtx);
+    }
+    pthread_mutex_unlock(&pool->mtx);
+    return NULL;
+}
+
+int num_cpus() {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#endif
+}
+
+ThreadPool* pool_create(int nthreads) {
+    ThreadPool *pool = (ThreadPool*)malloc(sizeof(ThreadPool));
+    pool->nthreads = nthreads;
+    pool->par_depth = 3;
+    while ((1 << (pool->par_depth - 3)) < nthreads) pool->par_depth++;
+    pool->head = NULL;
+    pool->stop = 0;
+    pthread_mutex_init(&pool->mtx, NULL);
+    pthread_cond_init(&pool->cond, NULL);
+    pool->threads = (pthread_t*)malloc(sizeof(pthread_t) * nthreads);
+    for (int i = 0; i < nthreads; i++)
+        pthread_create(&pool->threads[i], NULL, pool_worker, pool);
+    return pool;
+}
+
+void pool_destroy(ThreadPool *pool) {
+    pthread_mutex_lock(&pool->mtx);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->cond);
+    pthread_mutex_unlock(&pool->mtx);
+    for (int i = 0; i < pool->nthreads; i++)
+        pthread_join(pool->threads[i], NULL);
+    pthread_mutex_destroy(&pool->mtx);
+    pthread_cond_destroy(&pool->cond);
+    free(pool->threads);
+    free(pool);
+}
+
+static void pool_spawn(ThreadPool *pool, PoolTask *task, void (*fn)(void*), void *arg) {
+    task->fn = fn;
+    task->arg = arg;
+    task->done = 0;
+    pthread_mutex_lock(&pool->mtx);
+    task->next = pool->head;
+    pool->head = task;
+    pthread_cond_signal(&pool->cond);
+    pthread_mutex_unlock(&pool->mtx);
+}
+
+static void pool_wait(ThreadPool *pool, PoolTask *task) {
+    pthread_mutex_lock(&pool->mtx);
+    while (!task->done) {
+        PoolTask *other = pool->head;
+        if (!other) {
+            pthread_cond_wait(&pool->cond, &pool->mtx);
+            continue;
+        }
+        pool->head = other->next;
+        pthread_mutex_unlock(&pool->mtx);
+        pool_run(pool, other);
+        pthread_mutex_lock(&pool->mtx);
+    }
+    pthread_mutex_unlock(&pool->mtx);
+}
+
+// Decide se um nível da recursão ainda vale uma tarefa paralela
+static inline int pool_should_fork(ThreadPool *pool, int depth) {
+    return pool && depth < pool->par_depth;
+}
+
+// ====================== Operações em lote ==========================
+typedef enum { SET_UNION, SET_INTERSECTION, SET_DIFFERENCE } SetOp;
+
 // ====================== Árvore AVL ==========================
 typedef struct AVLNode {
     int key;
@@ -244,6 +470,194 @@ void avl_free(AVLNode* node) {
     free(node);
 }
 
+// ====================== Operações em lote (AVL) ==========================
+// Baseadas em join: join(L, k, R) liga duas árvores com todas as chaves de L
+// menores que k e as de R maiores, rodando só ao longo da espinha da mais alta.
+// Split, união, interseção e diferença são escritas sobre ele. As operações
+// consomem as árvores de entrada, reaproveitando seus nós.
+static AVLNode* avl_link(AVLNode *l, AVLNode *k, AVLNode *r) {
+    k->left = l;
+    k->right = r;
+    k->height = 1 + ((avl_height(l) > avl_height(r)) ? avl_height(l) : avl_height(r));
+    return k;
+}
+
+static AVLNode* avl_join_right(AVLNode *tl, AVLNode *k, AVLNode *tr) {
+    AVLNode *l = tl->left, *c = tl->right;
+    if (avl_height(c) <= avl_height(tr) + 1) {
+        AVLNode *t = avl_link(c, k, tr);
+        if (avl_height(t) <= avl_height(l) + 1) return avl_link(l, tl, t);
+        return avl_leftRotate(avl_link(l, tl, avl_rightRotate(t)));
+    }
+    AVLNode *t = avl_join_right(c, k, tr);
+    AVLNode *t2 = avl_link(l, tl, t);
+    if (avl_height(t) <= avl_height(l) + 1) return t2;
+    return avl_leftRotate(t2);
+}
+
+static AVLNode* avl_join_left(AVLNode *tl, AVLNode *k, AVLNode *tr) {
+    AVLNode *c = tr->left, *r = tr->right;
+    if (avl_height(c) <= avl_height(tl) + 1) {
+        AVLNode *t = avl_link(tl, k, c);
+        if (avl_height(t) <= avl_height(r) + 1) return avl_link(t, tr, r);
+        return avl_rightRotate(avl_link(avl_leftRotate(t), tr, r));
+    }
+    AVLNode *t = avl_join_left(tl, k, c);
+    AVLNode *t2 = avl_link(t, tr, r);
+    if (avl_height(t) <= avl_height(r) + 1) return t2;
+    return avl_rightRotate(t2);
+}
+
+static AVLNode* avl_join_mid(AVLNode *tl, AVLNode *k, AVLNode *tr) {
+    if (avl_height(tl) > avl_height(tr) + 1) return avl_join_right(tl, k, tr);
+    if (avl_height(tr) > avl_height(tl) + 1) return avl_join_left(tl, k, tr);
+    return avl_link(tl, k, tr);
+}
+
+// Separa t em chaves < key e > key; devolve o nó com a chave, se existir
+static AVLNode* avl_split_rec(AVLNode *t, int key, AVLNode **l, AVLNode **r) {
+    if (!t) {
+        *l = *r = NULL;
+        return NULL;
+    }
+    AVLNode *found;
+    if (key == t->key) {
+        *l = t->left;
+        *r = t->right;
+        return t;
+    }
+    if (key < t->key) {
+        AVLNode *rl;
+        found = avl_split_rec(t->left, key, l, &rl);
+        *r = avl_join_mid(rl, t, t->right);
+    } else {
+        AVLNode *lr;
+        found = avl_split_rec(t->right, key, &lr, r);
+        *l = avl_join_mid(t->left, t, lr);
+    }
+    return found;
+}
+
+static AVLNode* avl_split_last(AVLNode *t, AVLNode **rest) {
+    if (!t->right) {
+        *rest = t->left;
+        return t;
+    }
+    AVLNode *rr;
+    AVLNode *last = avl_split_last(t->right, &rr);
+    *rest = avl_join_mid(t->left, t, rr);
+    return last;
+}
+
+// Junta duas árvores com todas as chaves de tl menores que as de tr
+AVLNode* avl_join(AVLNode *tl, AVLNode *tr) {
+    if (!tl) return tr;
+    AVLNode *rest;
+    AVLNode *k = avl_split_last(tl, &rest);
+    return avl_join_mid(rest, k, tr);
+}
+
+// Separa a árvore em chaves < key (left) e >= key (right)
+void avl_split(AVLNode *root, int key, AVLNode **left, AVLNode **right) {
+    AVLNode *r;
+    AVLNode *found = avl_split_rec(root, key, left, &r);
+    *right = found ? avl_join_mid(NULL, found, r) : r;
+}
+
+typedef struct {
+    SetOp op;
+    AVLNode *t1, *t2;
+    ThreadPool *pool;
+    int depth;
+    AVLNode *result;
+} AVLSetOpTask;
+
+static AVLNode* avl_setop_rec(SetOp op, AVLNode *t1, AVLNode *t2, ThreadPool *pool, int depth);
+
+static void avl_setop_task(void *arg) {
+    AVLSetOpTask *a = (AVLSetOpTask*)arg;
+    a->result = avl_setop_rec(a->op, a->t1, a->t2, a->pool, a->depth);
+}
+
+static AVLNode* avl_setop_rec(SetOp op, AVLNode *t1, AVLNode *t2, ThreadPool *pool, int depth) {
+    if (!t1 || !t2) {
+        if (op == SET_UNION) return t1 ? t1 : t2;
+        avl_free(t2);
+        if (op == SET_INTERSECTION) {
+            avl_free(t1);
+            return NULL;
+        }
+        return t1;
+    }
+
+    AVLNode *l2, *r2;
+    AVLNode *m = avl_split_rec(t2, t1->key, &l2, &r2);
+    AVLNode *l, *r;
+
+    if (pool_should_fork(pool, depth)) {
+        AVLSetOpTask left = { op, t1->left, l2, pool, depth + 1, NULL };
+        PoolTask task;
+        pool_spawn(pool, &task, avl_setop_task, &left);
+        r = avl_setop_rec(op, t1->right, r2, pool, depth + 1);
+        pool_wait(pool, &task);
+        l = left.result;
+    } else {
+        l = avl_setop_rec(op, t1->left, l2, pool, depth + 1);
+        r = avl_setop_rec(op, t1->right, r2, pool, depth + 1);
+    }
+
+    if (m) free(m);
+    if ((op == SET_INTERSECTION && !m) || (op == SET_DIFFERENCE && m)) {
+        free(t1);
+        return avl_join(l, r);
+    }
+    return avl_join_mid(l, t1, r);
+}
+
+// União, interseção ou diferença (t1 - t2); pool NULL executa em série
+AVLNode* avl_set_operation(SetOp op, AVLNode *t1, AVLNode *t2, ThreadPool *pool) {
+    return avl_setop_rec(op, t1, t2, pool, 0);
+}
+
+typedef struct {
+    const int *keys;
+    int n;
+    ThreadPool *pool;
+    int depth;
+    AVLNode *result;
+} AVLBuildTask;
+
+static AVLNode* avl_build_rec(const int *keys, int n, ThreadPool *pool, int depth);
+
+static void avl_build_task(void *arg) {
+    AVLBuildTask *a = (AVLBuildTask*)arg;
+    a->result = avl_build_rec(a->keys, a->n, a->pool, a->depth);
+}
+
+static AVLNode* avl_build_rec(const int *keys, int n, ThreadPool *pool, int depth) {
+    if (n <= 0) return NULL;
+    int mid = n / 2;
+    AVLNode *node = avl_newNode(keys[mid]);
+    AVLNode *l, *r;
+    if (pool_should_fork(pool, depth)) {
+        AVLBuildTask left = { keys, mid, pool, depth + 1, NULL };
+        PoolTask task;
+        pool_spawn(pool, &task, avl_build_task, &left);
+        r = avl_build_rec(keys + mid + 1, n - mid - 1, pool, depth + 1);
+        pool_wait(pool, &task);
+        l = left.result;
+    } else {
+        l = avl_build_rec(keys, mid, pool, depth + 1);
+        r = avl_build_rec(keys + mid + 1, n - mid - 1, pool, depth + 1);
+    }
+    return avl_link(l, node, r);
+}
+
+// Constrói a árvore a partir de chaves ordenadas e distintas em O(n)
+AVLNode* avl_build_sorted(const int *keys, int n, ThreadPool *pool) {
+    return avl_build_rec(keys, n, pool, 0);
+}
+
 // ====================== Árvore Rubro-Negra ==========================
 typedef enum { RED, BLACK } Color;
 
@@ -360,59 +774,61 @@ void rb_transplant(RBTree *tree, RBNode *u, RBNode *v) {
     if (v) v->parent = u->parent;
 }
 
-void rb_deleteFixup(RBTree *tree, RBNode *x) {
+static inline int rb_is_black(RBNode *n) {
+    return !n || n->color == BLACK;
+}
 
-    while (x != tree->root && (!x || x->color == BLACK)) {
-        RBNode *xp = x ? x->parent : NULL;
-        if (!xp) break;
+// xp é o pai de x; precisa ser passado porque x pode ser NULL
+void rb_deleteFixup(RBTree *tree, RBNode *x, RBNode *xp) {
 
+    while (x != tree->root && rb_is_black(x)) {
         if (x == xp->left) {
             RBNode *w = xp->right;
-            if (w && w->color == RED) {
+            if (w->color == RED) {
                 w->color = BLACK;
                 xp->color = RED;
                 rb_leftRotate(tree, xp);
                 w = xp->right;
             }
-            if ((!w || !w->left || w->left->color == BLACK) &&
-                (!w || !w->right || w->right->color == BLACK)) {
-                if (w) w->color = RED;
+            if (rb_is_black(w->left) && rb_is_black(w->right)) {
+                w->color = RED;
                 x = xp;
+                xp = x->parent;
             } else {
-                if (!w || !w->right || w->right->color == BLACK) {
-                    if (w && w->left) w->left->color = BLACK;
-                    if (w) w->color = RED;
+                if (rb_is_black(w->right)) {
+                    w->left->color = BLACK;
+                    w->color = RED;
                     rb_rightRotate(tree, w);
                     w = xp->right;
                 }
-                if (w) w->color = xp->color;
+                w->color = xp->color;
                 xp->color = BLACK;
-                if (w && w->right) w->right->color = BLACK;
+                if (w->right) w->right->color = BLACK;
                 rb_leftRotate(tree, xp);
                 x = tree->root;
             }
         } else {
             RBNode *w = xp->left;
-            if (w && w->color == RED) {
+            if (w->color == RED) {
                 w->color = BLACK;
                 xp->color = RED;
                 rb_rightRotate(tree, xp);
                 w = xp->left;
             }
-            if ((!w || !w->right || w->right->color == BLACK) &&
-                (!w || !w->left || w->left->color == BLACK)) {
-                if (w) w->color = RED;
+            if (rb_is_black(w->right) && rb_is_black(w->left)) {
+                w->color = RED;
                 x = xp;
+                xp = x->parent;
             } else {
-                if (!w || !w->left || w->left->color == BLACK) {
-                    if (w && w->right) w->right->color = BLACK;
-                    if (w) w->color = RED;
+                if (rb_is_black(w->left)) {
+                    w->right->color = BLACK;
+                    w->color = RED;
                     rb_leftRotate(tree, w);
                     w = xp->left;
                 }
-                if (w) w->color = xp->color;
+                w->color = xp->color;
                 xp->color = BLACK;
-                if (w && w->left) w->left->color = BLACK;
+                if (w->left) w->left->color = BLACK;
                 rb_rightRotate(tree, xp);
                 x = tree->root;
             }
@@ -427,45 +843,31 @@ typedef struct {
     int64_t t_balance;
 } RBDelResult;
 
-RBDelResult rb_delete(RBTree *tree, int key) {
-    struct timespec ts1, ts2, ts3;
-    RBDelResult result = { tree->root, 0, 0 };
-    
-    
-    // 1) Busca o nó a ser removido
-    clock_gettime(CLOCK_MONOTONIC, &ts1);
-    RBNode *z = tree->root;
-    while (z) {
-        if (key < z->key) z = z->left;
-        else if (key > z->key) z = z->right;
-        else break;
-    }
-    clock_gettime(CLOCK_MONOTONIC, &ts2);
-    result.t_busca_remocao = diff_nsec(&ts1, &ts2);
-    
-    if (!z) {
-        result.raiz = tree->root;
-        return result;
-    }
-    
-    
+// Remove o nó z já localizado; devolve o tempo gasto no balanceamento
+static int64_t rb_delete_found(RBTree *tree, RBNode *z) {
+    struct timespec ts1, ts2;
     RBNode *y = z;
     Color y_original_color = y->color;
     RBNode *x = NULL;
-    
+    RBNode *xp = NULL;
+
     if (!z->left) {
         x = z->right;
+        xp = z->parent;
         rb_transplant(tree, z, z->right);
     } else if (!z->right) {
         x = z->left;
+        xp = z->parent;
         rb_transplant(tree, z, z->left);
     } else {
         y = rb_minimum(z->right);
         y_original_color = y->color;
         x = y->right;
         if (y->parent == z) {
+            xp = y;
             if (x) x->parent = y;
         } else {
+            xp = y->parent;
             rb_transplant(tree, y, y->right);
             y->right = z->right;
             y->right->parent = y;
@@ -476,15 +878,38 @@ RBDelResult rb_delete(RBTree *tree, int key) {
         y->color = z->color;
     }
     free(z);
+
+    clock_gettime(CLOCK_MONOTONIC, &ts1);
+    if (y_original_color == BLACK) {
+        rb_deleteFixup(tree, x, xp);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &ts2);
+    return diff_nsec(&ts1, &ts2);
+}
+
+RBDelResult rb_delete(RBTree *tree, int key) {
+    struct timespec ts1, ts2;
+    RBDelResult result = { tree->root, 0, 0 };
+    
     
-    // 2) Balanceamento
+    // 1) Busca o nó a ser removido
+    clock_gettime(CLOCK_MONOTONIC, &ts1);
+    RBNode *z = tree->root;
+    while (z) {
+        if (key < z->key) z = z->left;
+        else if (key > z->key) z = z->right;
+        else break;
+    }
     clock_gettime(CLOCK_MONOTONIC, &ts2);
-    if (y_original_color == BLACK) {
-        rb_deleteFixup(tree, x);
+    result.t_busca_remocao = diff_nsec(&ts1, &ts2);
+    
+    if (!z) {
+        result.raiz = tree->root;
+        return result;
     }
-    clock_gettime(CLOCK_MONOTONIC, &ts3);
     
-    result.t_balance = diff_nsec(&ts2, &ts3);
+    // 2) Remoção e balanceamento
+    result.t_balance = rb_delete_found(tree, z);
     result.raiz = tree->root;
     return result;
 }
@@ -496,6 +921,453 @@ void rb_free(RBNode* node) {
     free(node);
 }
 
+// ====================== Busca com finger (RB) ==========================
+// O finger guarda um nó e seu sucessor em ordem, ou seja, uma lacuna entre
+// duas chaves consecutivas (node NULL marca a lacuna antes do mínimo). Chaves
+// dentro da lacuna ou iguais às suas pontas, como na ingestão em ordem crescente
+// e na remoção em ordem, partem direto do finger em O(1). Nas demais a busca
+// sobe pelos pais até o menor ancestral que cobre a chave e desce a partir dele;
+// perto da espinha da árvore isso pode chegar à raiz, custando O(log n).
+// O finger só é válido enquanto todas as alterações da árvore passam por ele.
+typedef struct {
+    RBTree *tree;
+    RBNode *node;
+    RBNode *succ;
+} RBFinger;
+
+void rb_finger_init(RBFinger *f, RBTree *tree) {
+    f->tree = tree;
+    f->node = NULL;
+    f->succ = tree->root ? rb_minimum(tree->root) : NULL;
+}
+
+RBNode* rb_successor(RBNode *x) {
+    if (x->right) return rb_minimum(x->right);
+    RBNode *p = x->parent;
+    while (p && x == p->right) {
+        x = p;
+        p = p->parent;
+    }
+    return p;
+}
+
+RBNode* rb_predecessor(RBNode *x) {
+    if (x->left) {
+        x = x->left;
+        while (x->right) x = x->right;
+        return x;
+    }
+    RBNode *p = x->parent;
+    while (p && x == p->left) {
+        x = p;
+        p = p->parent;
+    }
+    return p;
+}
+
+// Nó de onde a descida parte. Em *hi fica o sucessor de qualquer chave inserida
+// na subárvore de partida que não desça à esquerda, quando ele é conhecido
+static RBNode* rb_finger_start(RBFinger *f, int key, RBNode **hi, int *hi_known) {
+    *hi = NULL;
+    *hi_known = 0;
+    RBNode *x;
+    if (f->node && key < f->node->key) {
+        x = f->node;
+        while (x->parent) {
+            RBNode *p = x->parent;
+            if (x == p->right && key > p->key) break;
+            x = p;
+        }
+        return x;
+    }
+    if (f->succ && key > f->succ->key) {
+        x = f->succ;
+        *hi_known = 1;
+        while (x->parent) {
+            RBNode *p = x->parent;
+            if (x == p->left && key < p->key) {
+                *hi = p;
+                break;
+            }
+            x = p;
+        }
+        return x;
+    }
+    if (f->node && key == f->node->key) return f->node;
+    if (f->succ && key == f->succ->key) return f->succ;
+
+    // Chave dentro da lacuna: ou node não tem filho direito, ou succ não tem esquerdo
+    *hi = f->succ;
+    *hi_known = 1;
+    if (f->node && !f->node->right) return f->node;
+    return f->succ;
+}
+
+void rb_finger_insert(RBFinger *f, int key) {
+    RBTree *tree = f->tree;
+    RBNode *z = rb_newNode(key);
+    RBNode *y = NULL;
+    RBNode *succ;
+    int succ_known;
+    RBNode *x = rb_finger_start(f, key, &succ, &succ_known);
+    while (x) {
+        y = x;
+        if (z->key < x->key) {
+            succ = x;
+            succ_known = 1;
+            x = x->left;
+        } else {
+            x = x->right;
+        }
+    }
+    z->parent = y;
+    if (!y) tree->root = z;
+    else if (z->key < y->key) y->left = z;
+    else y->right = z;
+    if (!succ_known) succ = rb_successor(z);
+    rb_insertFixup(tree, z);
+    f->node = z;
+    f->succ = succ;
+}
+
+RBDelResult rb_finger_delete(RBFinger *f, int key) {
+    RBTree *tree = f->tree;
+    struct timespec ts1, ts2;
+    RBDelResult result = { tree->root, 0, 0 };
+
+    // 1) Busca o nó a ser removido a partir do finger, junto com seus vizinhos
+    clock_gettime(CLOCK_MONOTONIC, &ts1);
+    RBNode *hi;
+    int hi_known;
+    RBNode *z = rb_finger_start(f, key, &hi, &hi_known);
+    while (z) {
+        if (key < z->key) z = z->left;
+        else if (key > z->key) z = z->right;
+        else break;
+    }
+    RBNode *pred = NULL, *succ = NULL;
+    if (z) {
+        pred = (z == f->succ) ? f->node : rb_predecessor(z);
+        succ = (z == f->node) ? f->succ : rb_successor(z);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &ts2);
+    result.t_busca_remocao = diff_nsec(&ts1, &ts2);
+
+    if (!z) {
+        result.raiz = tree->root;
+        return result;
+    }
+
+    // 2) Remoção e balanceamento; a lacuna deixada por z vira o novo finger
+    result.t_balance = rb_delete_found(tree, z);
+    f->node = pred;
+    f->succ = succ;
+    result.raiz = tree->root;
+    return result;
+}
+
+// ====================== Operações em lote (RB) ==========================
+// Mesmo esquema da AVL, guiado pela altura negra (bh): o número de nós pretos
+// de uma subárvore até NULL, contando a própria raiz. As funções recebem e
+// devolvem o bh de cada subárvore para que o join não precise recalculá-lo.
+static RBNode* rb_link(RBNode *l, RBNode *k, RBNode *r, Color color) {
+    k->left = l;
+    k->right = r;
+    k->color = color;
+    k->parent = NULL;
+    if (l) l->parent = k;
+    if (r) r->parent = k;
+    return k;
+}
+
+static RBNode* rb_rotate_left_sub(RBNode *x) {
+    RBNode *y = x->right;
+    x->right = y->left;
+    if (y->left) y->left->parent = x;
+    y->left = x;
+    x->parent = y;
+    y->parent = NULL;
+    return y;
+}
+
+static RBNode* rb_rotate_right_sub(RBNode *y) {
+    RBNode *x = y->left;
+    y->left = x->right;
+    if (x->right) x->right->parent = y;
+    x->right = y;
+    y->parent = x;
+    x->parent = NULL;
+    return x;
+}
+
+int rb_black_height(RBNode *n) {
+    int bh = 0;
+    for (; n; n = n->left)
+        if (n->color == BLACK) bh++;
+    return bh;
+}
+
+static RBNode* rb_join_right(RBNode *tl, int bh_l, RBNode *k, RBNode *tr, int bh_r) {
+    if (rb_is_black(tl) && bh_l == bh_r) return rb_link(tl, k, tr, RED);
+    RBNode *t = rb_join_right(tl->right, bh_l - (tl->color == BLACK), k, tr, bh_r);
+    tl->right = t;
+    t->parent = tl;
+    if (tl->color == BLACK && t->color == RED && t->right && t->right->color == RED) {
+        t->right->color = BLACK;
+        return rb_rotate_left_sub(tl);
+    }
+    return tl;
+}
+
+static RBNode* rb_join_left(RBNode *tl, int bh_l, RBNode *k, RBNode *tr, int bh_r) {
+    if (rb_is_black(tr) && bh_l == bh_r) return rb_link(tl, k, tr, RED);
+    RBNode *t = rb_join_left(tl, bh_l, k, tr->left, bh_r - (tr->color == BLACK));
+    tr->left = t;
+    t->parent = tr;
+    if (tr->color == BLACK && t->color == RED && t->left && t->left->color == RED) {
+        t->left->color = BLACK;
+        return rb_rotate_right_sub(tr);
+    }
+    return tr;
+}
+
+// Devolve sempre uma raiz preta, com seu bh em *bh_out
+static RBNode* rb_join_mid(RBNode *tl, int bh_l, RBNode *k, RBNode *tr, int bh_r, int *bh_out) {
+    if (tl && tl->color == RED) { tl->color = BLACK; bh_l++; }
+    if (tr && tr->color == RED) { tr->color = BLACK; bh_r++; }
+
+    RBNode *t;
+    int bh;
+    if (bh_l > bh_r) {
+        t = rb_join_right(tl, bh_l, k, tr, bh_r);
+        bh = bh_l;
+    } else if (bh_r > bh_l) {
+        t = rb_join_left(tl, bh_l, k, tr, bh_r);
+        bh = bh_r;
+    } else {
+        t = rb_link(tl, k, tr, RED);
+        bh = bh_l;
+    }
+    t->parent = NULL;
+    if (t->color == RED) {
+        t->color = BLACK;
+        bh++;
+    }
+    *bh_out = bh;
+    return t;
+}
+
+// Separa t em chaves < key e > key; devolve o nó com a chave, se existir
+static RBNode* rb_split_rec(RBNode *t, int bh, int key, RBNode **l, int *bh_l, RBNode **r, int *bh_r) {
+    if (!t) {
+        *l = *r = NULL;
+        *bh_l = *bh_r = 0;
+        return NULL;
+    }
+    int bh_c = bh - (t->color == BLACK);
+    RBNode *found;
+    if (key == t->key) {
+        *l = t->left;
+        *r = t->right;
+        *bh_l = *bh_r = bh_c;
+        if (*l) (*l)->parent = NULL;
+        if (*r) (*r)->parent = NULL;
+        return t;
+    }
+    if (key < t->key) {
+        RBNode *rl;
+        int bh_rl;
+        found = rb_split_rec(t->left, bh_c, key, l, bh_l, &rl, &bh_rl);
+        *r = rb_join_mid(rl, bh_rl, t, t->right, bh_c, bh_r);
+    } else {
+        RBNode *lr;
+        int bh_lr;
+        found = rb_split_rec(t->right, bh_c, key, &lr, &bh_lr, r, bh_r);
+        *l = rb_join_mid(t->left, bh_c, t, lr, bh_lr, bh_l);
+    }
+    return found;
+}
+
+static RBNode* rb_split_last(RBNode *t, int bh, RBNode **rest, int *bh_rest) {
+    int bh_c = bh - (t->color == BLACK);
+    if (!t->right) {
+        *rest = t->left;
+        *bh_rest = bh_c;
+        if (*rest) (*rest)->parent = NULL;
+        return t;
+    }
+    RBNode *rr;
+    int bh_rr;
+    RBNode *last = rb_split_last(t->right, bh_c, &rr, &bh_rr);
+    *rest = rb_join_mid(t->left, bh_c, t, rr, bh_rr, bh_rest);
+    return last;
+}
+
+static RBNode* rb_join2(RBNode *tl, int bh_l, RBNode *tr, int bh_r, int *bh_out) {
+    if (!tl) {
+        *bh_out = bh_r;
+        return tr;
+    }
+    RBNode *rest;
+    int bh_rest;
+    RBNode *k = rb_split_last(tl, bh_l, &rest, &bh_rest);
+    return rb_join_mid(rest, bh_rest, k, tr, bh_r, bh_out);
+}
+
+// Junta right em left; todas as chaves de left devem ser menores. right fica vazia
+void rb_join(RBTree *left, RBTree *right) {
+    int bh;
+    left->root = rb_join2(left->root, rb_black_height(left->root),
+                          right->root, rb_black_height(right->root), &bh);
+    if (left->root) {
+        left->root->parent = NULL;
+        left->root->color = BLACK;
+    }
+    right->root = NULL;
+}
+
+// Separa a árvore em chaves < key (left) e >= key (right); tree fica vazia
+void rb_split(RBTree *tree, int key, RBTree *left, RBTree *right) {
+    RBNode *l, *r;
+    int bh_l, bh_r;
+    RBNode *found = rb_split_rec(tree->root, rb_black_height(tree->root), key, &l, &bh_l, &r, &bh_r);
+    if (found) r = rb_join_mid(NULL, 0, found, r, bh_r, &bh_r);
+    if (l) {
+        l->parent = NULL;
+        l->color = BLACK;
+    }
+    if (r) {
+        r->parent = NULL;
+        r->color = BLACK;
+    }
+    left->root = l;
+    right->root = r;
+    tree->root = NULL;
+}
+
+typedef struct {
+    SetOp op;
+    RBNode *t1, *t2;
+    int bh1, bh2;
+    ThreadPool *pool;
+    int depth;
+    RBNode *result;
+    int bh_result;
+} RBSetOpTask;
+
+static RBNode* rb_setop_rec(SetOp op, RBNode *t1, int bh1, RBNode *t2, int bh2, int *bh_out,
+                            ThreadPool *pool, int depth);
+
+static void rb_setop_task(void *arg) {
+    RBSetOpTask *a = (RBSetOpTask*)arg;
+    a->result = rb_setop_rec(a->op, a->t1, a->bh1, a->t2, a->bh2, &a->bh_result, a->pool, a->depth);
+}
+
+static RBNode* rb_setop_rec(SetOp op, RBNode *t1, int bh1, RBNode *t2, int bh2, int *bh_out,
+                            ThreadPool *pool, int depth) {
+    if (!t1 || !t2) {
+        if (op == SET_UNION) {
+            *bh_out = t1 ? bh1 : bh2;
+            return t1 ? t1 : t2;
+        }
+        rb_free(t2);
+        if (op == SET_INTERSECTION) {
+            rb_free(t1);
+            *bh_out = 0;
+            return NULL;
+        }
+        *bh_out = bh1;
+        return t1;
+    }
+
+    RBNode *l2, *r2;
+    int bh_l2, bh_r2;
+    RBNode *m = rb_split_rec(t2, bh2, t1->key, &l2, &bh_l2, &r2, &bh_r2);
+    int bh_c = bh1 - (t1->color == BLACK);
+    RBNode *l1 = t1->left, *r1 = t1->right;
+    if (l1) l1->parent = NULL;
+    if (r1) r1->parent = NULL;
+    RBNode *l, *r;
+    int bh_l, bh_r;
+
+    if (pool_should_fork(pool, depth)) {
+        RBSetOpTask left = { op, l1, l2, bh_c, bh_l2, pool, depth + 1, NULL, 0 };
+        PoolTask task;
+        pool_spawn(pool, &task, rb_setop_task, &left);
+        r = rb_setop_rec(op, r1, bh_c, r2, bh_r2, &bh_r, pool, depth + 1);
+        pool_wait(pool, &task);
+        l = left.result;
+        bh_l = left.bh_result;
+    } else {
+        l = rb_setop_rec(op, l1, bh_c, l2, bh_l2, &bh_l, pool, depth + 1);
+        r = rb_setop_rec(op, r1, bh_c, r2, bh_r2, &bh_r, pool, depth + 1);
+    }
+
+    if (m) free(m);
+    if ((op == SET_INTERSECTION && !m) || (op == SET_DIFFERENCE && m)) {
+        free(t1);
+        return rb_join2(l, bh_l, r, bh_r, bh_out);
+    }
+    return rb_join_mid(l, bh_l, t1, r, bh_r, bh_out);
+}
+
+// União, interseção ou diferença (a - b) com resultado em a; b fica vazia.
+// pool NULL executa em série
+void rb_set_operation(SetOp op, RBTree *a, RBTree *b, ThreadPool *pool) {
+    int bh;
+    a->root = rb_setop_rec(op, a->root, rb_black_height(a->root),
+                           b->root, rb_black_height(b->root), &bh, pool, 0);
+    if (a->root) {
+        a->root->parent = NULL;
+        a->root->color = BLACK;
+    }
+    b->root = NULL;
+}
+
+typedef struct {
+    const int *keys;
+    int n;
+    int depth;
+    int red_depth;
+    ThreadPool *pool;
+    RBNode *result;
+} RBBuildTask;
+
+static RBNode* rb_build_rec(const int *keys, int n, int depth, int red_depth, ThreadPool *pool);
+
+static void rb_build_task(void *arg) {
+    RBBuildTask *a = (RBBuildTask*)arg;
+    a->result = rb_build_rec(a->keys, a->n, a->depth, a->red_depth, a->pool);
+}
+
+// Árvore perfeitamente balanceada: só o último nível, se incompleto, fica vermelho
+static RBNode* rb_build_rec(const int *keys, int n, int depth, int red_depth, ThreadPool *pool) {
+    if (n <= 0) return NULL;
+    int mid = n / 2;
+    RBNode *node = rb_newNode(keys[mid]);
+    RBNode *l, *r;
+    if (pool_should_fork(pool, depth)) {
+        RBBuildTask left = { keys, mid, depth + 1, red_depth, pool, NULL };
+        PoolTask task;
+        pool_spawn(pool, &task, rb_build_task, &left);
+        r = rb_build_rec(keys + mid + 1, n - mid - 1, depth + 1, red_depth, pool);
+        pool_wait(pool, &task);
+        l = left.result;
+    } else {
+        l = rb_build_rec(keys, mid, depth + 1, red_depth, pool);
+        r = rb_build_rec(keys + mid + 1, n - mid - 1, depth + 1, red_depth, pool);
+    }
+    return rb_link(l, node, r, depth == red_depth ? RED : BLACK);
+}
+
+// Constrói a árvore a partir de chaves ordenadas e distintas em O(n)
+void rb_build_sorted(RBTree *tree, const int *keys, int n, ThreadPool *pool) {
+    int red_depth = 0;
+    while ((2 << red_depth) <= n) red_depth++;
+    tree->root = rb_build_rec(keys, n, 0, red_depth, pool);
+    if (tree->root) tree->root->color = BLACK;
+}
+
 // ====================== Skip List ==========================
 #define SKIPLIST_MAX_LEVEL 32
 #define SKIPLIST_P 0.5
@@ -531,6 +1403,38 @@ int sl_randomLevel() {
     return lvl;
 }
 
+// Insere key logo após os predecessores update[1..sl->level] já localizados
+static void sl_insert_at(SkipList *sl, SLNode **update, int key) {
+    int lvl = sl_randomLevel();
+    if (lvl > sl->level) {
+        for (int i = sl->level + 1; i <= lvl; i++)
+            update[i] = sl->header;
+        sl->level = lvl;
+    }
+    SLNode *newNode = (SLNode*)malloc(sizeof(SLNode));
+    newNode->key = key;
+    newNode->nodeLevel = lvl;
+    newNode->forward = (SLNode**)malloc(sizeof(SLNode*) * (lvl + 1));
+    for (int i = 1; i <= lvl; i++) {
+        newNode->forward[i] = update[i]->forward[i];
+        update[i]->forward[i] = newNode;
+    }
+}
+
+// Desliga e libera x, cujos predecessores update[1..sl->level] já foram localizados
+static void sl_unlink(SkipList *sl, SLNode **update, SLNode *x) {
+    for (int i = 1; i <= sl->level; i++) {
+        if (update[i]->forward[i] != x) break;
+        update[i]->forward[i] = x->forward[i];
+    }
+    free(x->forward);
+    free(x);
+
+    while (sl->level > 1 && !sl->header->forward[sl->level]) {
+        sl->level--;
+    }
+}
+
 void sl_insert(SkipList *sl, int key) {
     SLNode *update[SKIPLIST_MAX_LEVEL + 1];
     SLNode *x = sl->header;
@@ -541,20 +1445,7 @@ void sl_insert(SkipList *sl, int key) {
     }
     x = x->forward[1];
     if (!x || x->key != key) {
-        int lvl = sl_randomLevel();
-        if (lvl > sl->level) {
-            for (int i = sl->level + 1; i <= lvl; i++)
-                update[i] = sl->header;
-            sl->level = lvl;
-        }
-        SLNode *newNode = (SLNode*)malloc(sizeof(SLNode));
-        newNode->key = key;
-        newNode->nodeLevel = lvl;
-        newNode->forward = (SLNode**)malloc(sizeof(SLNode*) * (lvl + 1));
-        for (int i = 1; i <= lvl; i++) {
-            newNode->forward[i] = update[i]->forward[i];
-            update[i]->forward[i] = newNode;
-        }
+        sl_insert_at(sl, update, key);
     }
 }
 
@@ -582,16 +1473,7 @@ SLDelResult sl_delete(SkipList *sl, int key) {
     
     if (x && x->key == key) {
         res.found = 1;
-        for (int i = 1; i <= sl->level; i++) {
-            if (update[i]->forward[i] != x) break;
-            update[i]->forward[i] = x->forward[i];
-        }
-        free(x->forward);
-        free(x);
-        
-        while (sl->level > 1 && !sl->header->forward[sl->level]) {
-            sl->level--;
-        }
+        sl_unlink(sl, update, x);
     } 
     res.t_balance = 0;
     return res;
@@ -610,14 +1492,238 @@ void sl_free(SkipList* sl) {
     free(sl);
 }
 
+// ====================== Busca com finger (Skip List) ==========================
+// O finger guarda o vetor update[] da última busca: update[i] é o último nó do
+// nível i com chave menor que f->key. Para uma chave maior, sobe-se de nível
+// enquanto o nível de cima ainda avança antes da chave, e desce-se a partir daí,
+// custando O(log d) esperado. Como a lista só tem ponteiros para frente, chaves
+// menores ou iguais a f->key recomeçam do header, em O(log n).
+// O finger só é válido enquanto todas as alterações da lista passam por ele.
+typedef struct {
+    SkipList *sl;
+    int key;
+    int valid;
+    SLNode *update[SKIPLIST_MAX_LEVEL + 1];
+} SLFinger;
+
+void sl_finger_init(SLFinger *f, SkipList *sl) {
+    f->sl = sl;
+    f->key = 0;
+    f->valid = 0;
+    for (int i = 0; i <= SKIPLIST_MAX_LEVEL; i++)
+        f->update[i] = sl->header;
+}
+
+// Preenche f->update[] para a chave e devolve o candidato no nível 1
+static SLNode* sl_finger_search(SLFinger *f, int key) {
+    SkipList *sl = f->sl;
+    SLNode *header = sl->header;
+    SLNode **update = f->update;
+
+    if (!f->valid || key <= f->key) {
+        for (int i = 1; i <= SKIPLIST_MAX_LEVEL; i++)
+            update[i] = header;
+    }
+
+    int top = 1;
+    while (top < sl->level && update[top + 1]->forward[top + 1] &&
+           update[top + 1]->forward[top + 1]->key < key)
+        top++;
+
+    SLNode *x = update[top];
+    for (int i = top; i >= 1; i--) {
+        if (x == header || (update[i] != header && update[i]->key > x->key))
+            x = update[i];
+        while (x->forward[i] && x->forward[i]->key < key)
+            x = x->forward[i];
+        update[i] = x;
+    }
+    f->key = key;
+    f->valid = 1;
+    return x->forward[1];
+}
+
+void sl_finger_insert(SLFinger *f, int key) {
+    SLNode *x = sl_finger_search(f, key);
+    if (!x || x->key != key) {
+        sl_insert_at(f->sl, f->update, key);
+    }
+}
+
+SLDelResult sl_finger_delete(SLFinger *f, int key) {
+    SLDelResult res = { 0, 0, 0 };
+    struct timespec ts1, ts2;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts1);
+    SLNode *x = sl_finger_search(f, key);
+    clock_gettime(CLOCK_MONOTONIC, &ts2);
+    res.t_busca_remocao = diff_nsec(&ts1, &ts2);
+
+    if (x && x->key == key) {
+        res.found = 1;
+        sl_unlink(f->sl, f->update, x);
+    }
+    res.t_balance = 0;
+    return res;
+}
+
+// ====================== Operações em lote (Skip List) ==========================
+// Baseadas em intercalação: as duas listas são percorridas no nível 1 e cada nó
+// mantido é anexado ao fim do resultado com seu nível original, em O(n + m).
+// Split e join só cortam ou religam os ponteiros de cada nível, em O(log n).
+static void sl_append(SLNode **tail, SLNode *x) {
+    for (int i = 1; i <= x->nodeLevel; i++) {
+        tail[i]->forward[i] = x;
+        tail[i] = x;
+    }
+}
+
+static void sl_free_node(SLNode *x) {
+    free(x->forward);
+    free(x);
+}
+
+static void sl_fix_level(SkipList *sl) {
+    sl->level = SKIPLIST_MAX_LEVEL;
+    while (sl->level > 1 && !sl->header->forward[sl->level])
+        sl->level--;
+}
+
+// União, interseção ou diferença (a - b) com resultado em a; b fica vazia
+void sl_set_operation(SetOp op, SkipList *a, SkipList *b) {
+    SLNode *tail[SKIPLIST_MAX_LEVEL + 1];
+    SLNode *x = a->header->forward[1];
+    SLNode *y = b->header->forward[1];
+    for (int i = 0; i <= SKIPLIST_MAX_LEVEL; i++) {
+        a->header->forward[i] = NULL;
+        b->header->forward[i] = NULL;
+        tail[i] = a->header;
+    }
+
+    while (x && y) {
+        if (x->key < y->key) {
+            SLNode *next = x->forward[1];
+            if (op != SET_INTERSECTION) sl_append(tail, x);
+            else sl_free_node(x);
+            x = next;
+        } else if (y->key < x->key) {
+            SLNode *next = y->forward[1];
+            if (op == SET_UNION) sl_append(tail, y);
+            else sl_free_node(y);
+            y = next;
+        } else {
+            SLNode *next_x = x->forward[1], *next_y = y->forward[1];
+            if (op != SET_DIFFERENCE) sl_append(tail, x);
+            else sl_free_node(x);
+            sl_free_node(y);
+            x = next_x;
+            y = next_y;
+        }
+    }
+    while (x) {
+        SLNode *next = x->forward[1];
+        if (op != SET_INTERSECTION) sl_append(tail, x);
+        else sl_free_node(x);
+        x = next;
+    }
+    while (y) {
+        SLNode *next = y->forward[1];
+        if (op == SET_UNION) sl_append(tail, y);
+        else sl_free_node(y);
+        y = next;
+    }
+
+    for (int i = 1; i <= SKIPLIST_MAX_LEVEL; i++)
+        tail[i]->forward[i] = NULL;
+    sl_fix_level(a);
+    b->level = 1;
+}
+
+// Move as chaves >= key para uma nova lista, que é devolvida
+SkipList* sl_split(SkipList *sl, int key) {
+    SkipList *right = sl_create();
+    SLNode *x = sl->header;
+    for (int i = sl->level; i >= 1; i--) {
+        while (x->forward[i] && x->forward[i]->key < key)
+            x = x->forward[i];
+        right->header->forward[i] = x->forward[i];
+        x->forward[i] = NULL;
+    }
+    sl_fix_level(sl);
+    sl_fix_level(right);
+    return right;
+}
+
+// Anexa b ao fim de a; todas as chaves de a devem ser menores. b fica vazia
+void sl_join(SkipList *a, SkipList *b) {
+    SLNode *x = a->header;
+    for (int i = SKIPLIST_MAX_LEVEL; i >= 1; i--) {
+        while (x->forward[i])
+            x = x->forward[i];
+        if (i <= b->level) {
+            x->forward[i] = b->header->forward[i];
+            b->header->forward[i] = NULL;
+        }
+    }
+    if (b->level > a->level) a->level = b->level;
+    b->level = 1;
+}
+
+// Constrói a lista a partir de chaves ordenadas e distintas em O(n)
+SkipList* sl_build_sorted(const int *keys, int n) {
+    SkipList *sl = sl_create();
+    SLNode *tail[SKIPLIST_MAX_LEVEL + 1];
+    for (int i = 0; i <= SKIPLIST_MAX_LEVEL; i++)
+        tail[i] = sl->header;
+    for (int j = 0; j < n; j++) {
+        int lvl = sl_randomLevel();
+        SLNode *node = (SLNode*)malloc(sizeof(SLNode));
+        node->key = keys[j];
+        node->nodeLevel = lvl;
+        node->forward = (SLNode**)malloc(sizeof(SLNode*) * (lvl + 1));
+        for (int i = 1; i <= lvl; i++)
+            node->forward[i] = NULL;
+        sl_append(tail, node);
+        if (lvl > sl->level) sl->level = lvl;
+    }
+    return sl;
+}
+
 // ====================== Função de experimento ==========================
-void experimento_para_tamanho(int N, FILE *csv) {
+enum { FASE_BUSCA_REMOCAO, FASE_BALANCEAMENTO, FASE_TOTAL, NUM_FASES };
+static const char *nomes_fase[] = { "BuscaRemocao", "Balanceamento", "Total" };
+
+// Registra a latência da i-ésima remoção em cada fase, respeitando a amostragem
+static inline void hist_record_op(LatencyHist *hist, int i, int64_t busca, int64_t bal) {
+    if (i % HIST_AMOSTRAGEM) return;
+    hist_record(&hist[FASE_BUSCA_REMOCAO], busca);
+    hist_record(&hist[FASE_BALANCEAMENTO], bal);
+    hist_record(&hist[FASE_TOTAL], busca + bal);
+}
+
+static void hist_report(LatencyHist *hist, const char *estrutura, int N, FILE *csv_lat, FILE *csv_pct) {
+    for (int f = 0; f < NUM_FASES; f++) {
+        hist_print(&hist[f], estrutura, nomes_fase[f]);
+        hist_write_csv(&hist[f], csv_lat, estrutura, N, nomes_fase[f]);
+        hist_write_percentis(&hist[f], csv_pct, estrutura, N, nomes_fase[f]);
+    }
+}
+
+void experimento_para_tamanho(int N, FILE *csv, FILE *csv_lat, FILE *csv_pct) {
     printf("Iniciando experimento para N = %d\n", N);
 
     int64_t menor_total_avl = INT64_MAX, menor_busca_avl = 0, menor_bal_avl = 0;
     int64_t menor_total_rb = INT64_MAX, menor_busca_rb = 0, menor_bal_rb = 0;
     int64_t menor_total_sl = INT64_MAX, menor_busca_sl = 0, menor_bal_sl = 0;
 
+    // Histogramas acumulam as amostras de todas as tentativas
+    static LatencyHist hist_avl[NUM_FASES], hist_rb[NUM_FASES], hist_sl[NUM_FASES];
+    for (int f = 0; f < NUM_FASES; f++) {
+        hist_reset(&hist_avl[f]);
+        hist_reset(&hist_rb[f]);
+        hist_reset(&hist_sl[f]);
+    }
+
     for (int tentativa = 0; tentativa < 1; tentativa++) {
         printf("Tentativa %d para N = %d\n", tentativa + 1, N);
 
@@ -633,6 +1739,7 @@ void experimento_para_tamanho(int N, FILE *csv) {
             root_avl = avl_deleteNode(root_avl, vetor[i], &b, &t);
             busca_avl += b;
             bal_avl += t;
+            hist_record_op(hist_avl, i, b, t);
         }
         avl_free(root_avl);
         printf("AVL: finalizado\n");
@@ -653,6 +1760,7 @@ void experimento_para_tamanho(int N, FILE *csv) {
             RBDelResult res = rb_delete(&rb_tree, vetor[i]);
             busca_rb += res.t_busca_remocao;
             bal_rb += res.t_balance;
+            hist_record_op(hist_rb, i, res.t_busca_remocao, res.t_balance);
         }
         rb_free(rb_tree.root);
         printf("RB: finalizado\n");
@@ -673,6 +1781,7 @@ void experimento_para_tamanho(int N, FILE *csv) {
             SLDelResult res = sl_delete(sl, vetor[i]);
             busca_sl += res.t_busca_remocao;
             bal_sl += res.t_balance;
+            hist_record_op(hist_sl, i, res.t_busca_remocao, res.t_balance);
         }
         sl_free(sl);
         printf("SkipList: finalizado\n");
@@ -691,9 +1800,260 @@ void experimento_para_tamanho(int N, FILE *csv) {
     fprintf(csv, "RB,%d,%" PRId64 ",%" PRId64 ",%" PRId64 "\n", N, menor_busca_rb, menor_bal_rb, menor_total_rb);
     fprintf(csv, "SkipList,%d,%" PRId64 ",%" PRId64 ",%" PRId64 "\n", N, menor_busca_sl, menor_bal_sl, menor_total_sl);
     fflush(csv);
+
+    hist_report(hist_avl, "AVL", N, csv_lat, csv_pct);
+    hist_report(hist_rb, "RB", N, csv_lat, csv_pct);
+    hist_report(hist_sl, "SkipList", N, csv_lat, csv_pct);
+    fflush(csv_lat);
+    fflush(csv_pct);
     printf("Experimento N = %d finalizado\n", N);
 }
 
+// Fase em ordem crescente: compara a busca a partir da raiz/header com a busca
+// por finger, tanto na ingestão das chaves quanto na remoção
+void experimento_ordenado(int N, FILE *csv) {
+    printf("Iniciando experimento ordenado para N = %d\n", N);
+    struct timespec ts1, ts2;
+
+    int *vetor = gera_vetor_ordenado(N);
+
+    // RB, busca a partir da raiz
+    RBTree rb_tree = { NULL };
+    clock_gettime(CLOCK_MONOTONIC, &ts1);
+    for (int i = 0; i < N; i++) rb_insert(&rb_tree, vetor[i]);
+    clock_gettime(CLOCK_MONOTONIC, &ts2);
+    int64_t ins_rb = diff_nsec(&ts1, &ts2);
+
+    int64_t busca_rb = 0, bal_rb = 0;
+    for (int i = 0; i < N; i++) {
+        RBDelResult res = rb_delete(&rb_tree, vetor[i]);
+        busca_rb += res.t_busca_remocao;
+        bal_rb += res.t_balance;
+    }
+    rb_free(rb_tree.root);
+
+    // RB, busca por finger
+    RBTree rb_finger_tree = { NULL };
+    RBFinger rb_f;
+    rb_finger_init(&rb_f, &rb_finger_tree);
+    clock_gettime(CLOCK_MONOTONIC, &ts1);
+    for (int i = 0; i < N; i++) rb_finger_insert(&rb_f, vetor[i]);
+    clock_gettime(CLOCK_MONOTONIC, &ts2);
+    int64_t ins_rbf = diff_nsec(&ts1, &ts2);
+
+    rb_finger_init(&rb_f, &rb_finger_tree);
+    int64_t busca_rbf = 0, bal_rbf = 0;
+    for (int i = 0; i < N; i++) {
+        RBDelResult res = rb_finger_delete(&rb_f, vetor[i]);
+        busca_rbf += res.t_busca_remocao;
+        bal_rbf += res.t_balance;
+    }
+    rb_free(rb_finger_tree.root);
+    printf("RB ordenado: finalizado\n");
+
+    // Skip List, busca a partir do header
+    SkipList *sl = sl_create();
+    clock_gettime(CLOCK_MONOTONIC, &ts1);
+    for (int i = 0; i < N; i++) sl_insert(sl, vetor[i]);
+    clock_gettime(CLOCK_MONOTONIC, &ts2);
+    int64_t ins_sl = diff_nsec(&ts1, &ts2);
+
+    int64_t busca_sl = 0, bal_sl = 0;
+    for (int i = 0; i < N; i++) {
+        SLDelResult res = sl_delete(sl, vetor[i]);
+        busca_sl += res.t_busca_remocao;
+        bal_sl += res.t_balance;
+    }
+    sl_free(sl);
+
+    // Skip List, busca por finger
+    SkipList *slf = sl_create();
+    SLFinger sl_f;
+    sl_finger_init(&sl_f, slf);
+    clock_gettime(CLOCK_MONOTONIC, &ts1);
+    for (int i = 0; i < N; i++) sl_finger_insert(&sl_f, vetor[i]);
+    clock_gettime(CLOCK_MONOTONIC, &ts2);
+    int64_t ins_slf = diff_nsec(&ts1, &ts2);
+
+    sl_finger_init(&sl_f, slf);
+    int64_t busca_slf = 0, bal_slf = 0;
+    for (int i = 0; i < N; i++) {
+        SLDelResult res = sl_finger_delete(&sl_f, vetor[i]);
+        busca_slf += res.t_busca_remocao;
+        bal_slf += res.t_balance;
+    }
+    sl_free(slf);
+    printf("SkipList ordenado: finalizado\n");
+
+    free(vetor);
+
+    fprintf(csv, "RB,%d,%" PRId64 ",%" PRId64 ",%" PRId64 ",%" PRId64 "\n", N, ins_rb, busca_rb, bal_rb, busca_rb + bal_rb);
+    fprintf(csv, "RB-Finger,%d,%" PRId64 ",%" PRId64 ",%" PRId64 ",%" PRId64 "\n", N, ins_rbf, busca_rbf, bal_rbf, busca_rbf + bal_rbf);
+    fprintf(csv, "SkipList,%d,%" PRId64 ",%" PRId64 ",%" PRId64 ",%" PRId64 "\n", N, ins_sl, busca_sl, bal_sl, busca_sl + bal_sl);
+    fprintf(csv, "SkipList-Finger,%d,%" PRId64 ",%" PRId64 ",%" PRId64 ",%" PRId64 "\n", N, ins_slf, busca_slf, bal_slf, busca_slf + bal_slf);
+    fflush(csv);
+    printf("Experimento ordenado N = %d finalizado\n", N);
+}
+
+// ====================== Experimento de operações em lote ==========================
+static const char *nomes_setop[] = { "Uniao", "Intersecao", "Diferenca" };
+
+static int* copia_ordenada(const int *v, int n) {
+    int *c = malloc(n * sizeof(int));
+    if (!c) exit(EXIT_FAILURE);
+    memcpy(c, v, n * sizeof(int));
+    qsort(c, n, sizeof(int), compara_int);
+    return c;
+}
+
+// Por padrão b já vem ordenado e sua estrutura é montada fora do tempo medido,
+// como um índice delta pronto. Com b_bruto, b é o delta na ordem de chegada e o
+// tempo inclui ordená-lo e construir sua estrutura.
+static int64_t mede_avl_setop(SetOp op, const int *a, int na, const int *b, int nb, ThreadPool *pool, int b_bruto) {
+    struct timespec ts1, ts2;
+    AVLNode *t1 = avl_build_sorted(a, na, pool);
+    AVLNode *t2 = b_bruto ? NULL : avl_build_sorted(b, nb, pool);
+    clock_gettime(CLOCK_MONOTONIC, &ts1);
+    if (b_bruto) {
+        int *ord = copia_ordenada(b, nb);
+        t2 = avl_build_sorted(ord, nb, pool);
+        free(ord);
+    }
+    AVLNode *t = avl_set_operation(op, t1, t2, pool);
+    clock_gettime(CLOCK_MONOTONIC, &ts2);
+    avl_free(t);
+    return diff_nsec(&ts1, &ts2);
+}
+
+static int64_t mede_rb_setop(SetOp op, const int *a, int na, const int *b, int nb, ThreadPool *pool, int b_bruto) {
+    struct timespec ts1, ts2;
+    RBTree t1 = { NULL }, t2 = { NULL };
+    rb_build_sorted(&t1, a, na, pool);
+    if (!b_bruto) rb_build_sorted(&t2, b, nb, pool);
+    clock_gettime(CLOCK_MONOTONIC, &ts1);
+    if (b_bruto) {
+        int *ord = copia_ordenada(b, nb);
+        rb_build_sorted(&t2, ord, nb, pool);
+        free(ord);
+    }
+    rb_set_operation(op, &t1, &t2, pool);
+    clock_gettime(CLOCK_MONOTONIC, &ts2);
+    rb_free(t1.root);
+    return diff_nsec(&ts1, &ts2);
+}
+
+static int64_t mede_sl_setop(SetOp op, const int *a, int na, const int *b, int nb, int b_bruto) {
+    struct timespec ts1, ts2;
+    SkipList *s1 = sl_build_sorted(a, na);
+    SkipList *s2 = b_bruto ? NULL : sl_build_sorted(b, nb);
+    clock_gettime(CLOCK_MONOTONIC, &ts1);
+    if (b_bruto) {
+        int *ord = copia_ordenada(b, nb);
+        s2 = sl_build_sorted(ord, nb);
+        free(ord);
+    }
+    sl_set_operation(op, s1, s2);
+    clock_gettime(CLOCK_MONOTONIC, &ts2);
+    sl_free(s1);
+    sl_free(s2);
+    return diff_nsec(&ts1, &ts2);
+}
+
+// Índice principal A e delta B, com um quarto das chaves em comum. A união em
+// lote é comparada com a inserção das chaves de B uma a uma em A, tanto com B
+// já indexado (Uniao) quanto partindo do delta bruto (UniaoComConstrucao).
+void experimento_bulk(int N, FILE *csv, ThreadPool *pool) {
+    printf("Iniciando experimento em lote para N = %d\n", N);
+    struct timespec ts1, ts2;
+
+    int *vetor = gera_vetor(N);
+    int na = N - N / 4, nb = N / 2;
+    const int *delta = vetor + N / 2;
+    int *a = copia_ordenada(vetor, na);
+    int *b = copia_ordenada(delta, nb);
+
+    // AVL
+    AVLNode *root_avl = avl_build_sorted(a, na, NULL);
+    clock_gettime(CLOCK_MONOTONIC, &ts1);
+    for (int i = 0; i < nb; i++) root_avl = avl_insert(root_avl, delta[i]);
+    clock_gettime(CLOCK_MONOTONIC, &ts2);
+    avl_free(root_avl);
+    fprintf(csv, "AVL,%d,InsercaoUnitaria,%" PRId64 "\n", N, diff_nsec(&ts1, &ts2));
+
+    clock_gettime(CLOCK_MONOTONIC, &ts1);
+    root_avl = avl_build_sorted(a, na, NULL);
+    clock_gettime(CLOCK_MONOTONIC, &ts2);
+    avl_free(root_avl);
+    fprintf(csv, "AVL,%d,Construcao,%" PRId64 "\n", N, diff_nsec(&ts1, &ts2));
+
+    clock_gettime(CLOCK_MONOTONIC, &ts1);
+    root_avl = avl_build_sorted(a, na, pool);
+    clock_gettime(CLOCK_MONOTONIC, &ts2);
+    avl_free(root_avl);
+    fprintf(csv, "AVL,%d,ConstrucaoParalela,%" PRId64 "\n", N, diff_nsec(&ts1, &ts2));
+
+    for (int op = SET_UNION; op <= SET_DIFFERENCE; op++) {
+        fprintf(csv, "AVL,%d,%s,%" PRId64 "\n", N, nomes_setop[op], mede_avl_setop(op, a, na, b, nb, NULL, 0));
+        fprintf(csv, "AVL,%d,%sParalela,%" PRId64 "\n", N, nomes_setop[op], mede_avl_setop(op, a, na, b, nb, pool, 0));
+    }
+    fprintf(csv, "AVL,%d,UniaoComConstrucao,%" PRId64 "\n", N, mede_avl_setop(SET_UNION, a, na, delta, nb, NULL, 1));
+    fprintf(csv, "AVL,%d,UniaoComConstrucaoParalela,%" PRId64 "\n", N, mede_avl_setop(SET_UNION, a, na, delta, nb, pool, 1));
+    printf("AVL em lote: finalizado\n");
+
+    // RB
+    RBTree rb_tree = { NULL };
+    rb_build_sorted(&rb_tree, a, na, NULL);
+    clock_gettime(CLOCK_MONOTONIC, &ts1);
+    for (int i = 0; i < nb; i++) rb_insert(&rb_tree, delta[i]);
+    clock_gettime(CLOCK_MONOTONIC, &ts2);
+    rb_free(rb_tree.root);
+    fprintf(csv, "RB,%d,InsercaoUnitaria,%" PRId64 "\n", N, diff_nsec(&ts1, &ts2));
+
+    clock_gettime(CLOCK_MONOTONIC, &ts1);
+    rb_build_sorted(&rb_tree, a, na, NULL);
+    clock_gettime(CLOCK_MONOTONIC, &ts2);
+    rb_free(rb_tree.root);
+    fprintf(csv, "RB,%d,Construcao,%" PRId64 "\n", N, diff_nsec(&ts1, &ts2));
+
+    clock_gettime(CLOCK_MONOTONIC, &ts1);
+    rb_build_sorted(&rb_tree, a, na, pool);
+    clock_gettime(CLOCK_MONOTONIC, &ts2);
+    rb_free(rb_tree.root);
+    fprintf(csv, "RB,%d,ConstrucaoParalela,%" PRId64 "\n", N, diff_nsec(&ts1, &ts2));
+
+    for (int op = SET_UNION; op <= SET_DIFFERENCE; op++) {
+        fprintf(csv, "RB,%d,%s,%" PRId64 "\n", N, nomes_setop[op], mede_rb_setop(op, a, na, b, nb, NULL, 0));
+        fprintf(csv, "RB,%d,%sParalela,%" PRId64 "\n", N, nomes_setop[op], mede_rb_setop(op, a, na, b, nb, pool, 0));
+    }
+    fprintf(csv, "RB,%d,UniaoComConstrucao,%" PRId64 "\n", N, mede_rb_setop(SET_UNION, a, na, delta, nb, NULL, 1));
+    fprintf(csv, "RB,%d,UniaoComConstrucaoParalela,%" PRId64 "\n", N, mede_rb_setop(SET_UNION, a, na, delta, nb, pool, 1));
+    printf("RB em lote: finalizado\n");
+
+    // Skip List
+    SkipList *sl = sl_build_sorted(a, na);
+    clock_gettime(CLOCK_MONOTONIC, &ts1);
+    for (int i = 0; i < nb; i++) sl_insert(sl, delta[i]);
+    clock_gettime(CLOCK_MONOTONIC, &ts2);
+    sl_free(sl);
+    fprintf(csv, "SkipList,%d,InsercaoUnitaria,%" PRId64 "\n", N, diff_nsec(&ts1, &ts2));
+
+    clock_gettime(CLOCK_MONOTONIC, &ts1);
+    sl = sl_build_sorted(a, na);
+    clock_gettime(CLOCK_MONOTONIC, &ts2);
+    sl_free(sl);
+    fprintf(csv, "SkipList,%d,Construcao,%" PRId64 "\n", N, diff_nsec(&ts1, &ts2));
+
+    for (int op = SET_UNION; op <= SET_DIFFERENCE; op++)
+        fprintf(csv, "SkipList,%d,%s,%" PRId64 "\n", N, nomes_setop[op], mede_sl_setop(op, a, na, b, nb, 0));
+    fprintf(csv, "SkipList,%d,UniaoComConstrucao,%" PRId64 "\n", N, mede_sl_setop(SET_UNION, a, na, delta, nb, 1));
+    printf("SkipList em lote: finalizado\n");
+
+    free(a);
+    free(b);
+    free(vetor);
+    fflush(csv);
+    printf("Experimento em lote N = %d finalizado\n", N);
+}
 
 int main() {
     srand(12345);
@@ -703,13 +2063,47 @@ int main() {
     FILE *csv = fopen("../resultados/resultados.csv", "w");
     if (!csv) return EXIT_FAILURE;
 
+    FILE *csv_ord = fopen("../resultados/resultados_ordenado.csv", "w");
+    if (!csv_ord) return EXIT_FAILURE;
+
+    FILE *csv_bulk = fopen("../resultados/resultados_bulk.csv", "w");
+    if (!csv_bulk) return EXIT_FAILURE;
+
+    FILE *csv_lat = fopen("../resultados/latencias.csv", "w");
+    if (!csv_lat) return EXIT_FAILURE;
+
+    FILE *csv_pct = fopen("../resultados/percentis.csv", "w");
+    if (!csv_pct) return EXIT_FAILURE;
+
     fprintf(csv, "Estrutura,N,TempoBuscaRemocao(ns),TempoBalanceamento(ns),TempoTotal(ns)\n");
     fflush(csv);
+    fprintf(csv_ord, "Estrutura,N,TempoInsercao(ns),TempoBuscaRemocao(ns),TempoBalanceamento(ns),TempoTotal(ns)\n");
+    fflush(csv_ord);
+    fprintf(csv_bulk, "Estrutura,N,Operacao,Tempo(ns)\n");
+    fflush(csv_bulk);
+    fprintf(csv_lat, "Estrutura,N,Fase,Latencia(ns),Contagem,FracaoAcumulada\n");
+    fflush(csv_lat);
+    fprintf(csv_pct, "Estrutura,N,Fase,p50(ns),p90(ns),p99(ns),p99.9(ns),max(ns)\n");
+    fflush(csv_pct);
+
+    ThreadPool *pool = pool_create(num_cpus());
 
     for (int i = 0; i < num_tamanhos; i++) {
-        experimento_para_tamanho(tamanhos[i], csv);
+        experimento_para_tamanho(tamanhos[i], csv, csv_lat, csv_pct);
         fflush(csv);
     }
+
+    // As fases novas rodam depois para não mudar a sequência de rand() do
+    // experimento principal, mantendo resultados.csv reproduzível
+    for (int i = 0; i < num_tamanhos; i++)
+        experimento_ordenado(tamanhos[i], csv_ord);
+    for (int i = 0; i < num_tamanhos; i++)
+        experimento_bulk(tamanhos[i], csv_bulk, pool);
+    pool_destroy(pool);
+    fclose(csv_pct);
+    fclose(csv_lat);
+    fclose(csv_bulk);
+    fclose(csv_ord);
     fclose(csv);
     return 0;
 }
@@ -1,3 +1,4 @@
+import os
 import pandas as pd
 import matplotlib.pyplot as plt
 
@@ -11,12 +12,13 @@ sizes = [
     390000, 420000, 450000, 480000, 500000
 ]
 
-def plot_metric(metric, ylabel, filename, skip_zero=False):
+def plot_metric(metric, ylabel, filename, skip_zero=False, estruturas=("AVL", "RB", "SkipList"), origem=None):
+    origem = df if origem is None else origem
     plt.figure()
-    for estrutura in ["AVL", "RB", "SkipList"]:
+    for estrutura in estruturas:
         if skip_zero and estrutura == "SkipList":
             continue
-        dados = df[(df["Estrutura"] == estrutura) & (df["N"].isin(sizes))]
+        dados = origem[(origem["Estrutura"] == estrutura) & (origem["N"].isin(sizes))]
         plt.plot(dados["N"], dados[metric], label=estrutura, marker='o')
 
     plt.xlabel("N")
@@ -35,4 +37,63 @@ plot_metric("TempoBuscaRemocao(ns)", "Tempo Busca+Remocao (ns)", "../graficos/gr
 plot_metric("TempoBalanceamento(ns)", "Tempo Balanceamento (ns)", "../graficos/grafico_balanceamento.png", skip_zero=True)
 plot_metric("TempoTotal(ns)", "Tempo Total (ns)", "../graficos/grafico_total.png")
 
+# Fase em ordem crescente, com e sem finger
+if os.path.exists("../resultados/resultados_ordenado.csv"):
+    ordenado = pd.read_csv("../resultados/resultados_ordenado.csv")
+    estruturas_ordenado = ("RB", "RB-Finger", "SkipList", "SkipList-Finger")
+    plot_metric("TempoInsercao(ns)", "Tempo Insercao Ordenada (ns)", "../graficos/grafico_ordenado_insercao.png",
+                estruturas=estruturas_ordenado, origem=ordenado)
+    plot_metric("TempoBuscaRemocao(ns)", "Tempo Busca+Remocao Ordenada (ns)", "../graficos/grafico_ordenado.png",
+                estruturas=estruturas_ordenado, origem=ordenado)
+
+# Operações em lote: união (série e paralela) contra inserção chave a chave
+if os.path.exists("../resultados/resultados_bulk.csv"):
+    bulk = pd.read_csv("../resultados/resultados_bulk.csv")
+    plt.figure()
+    for estrutura in ["AVL", "RB", "SkipList"]:
+        for operacao in ["InsercaoUnitaria", "Uniao", "UniaoParalela", "UniaoComConstrucao", "UniaoComConstrucaoParalela"]:
+            dados = bulk[(bulk["Estrutura"] == estrutura) & (bulk["Operacao"] == operacao) & (bulk["N"].isin(sizes))]
+            if dados.empty:
+                continue
+            plt.plot(dados["N"], dados["Tempo(ns)"], label=f"{estrutura} {operacao}", marker='o')
+
+    plt.xlabel("N")
+    plt.ylabel("Tempo (ns)")
+    plt.title("Uniao em lote x Insercao unitaria (ns)")
+    plt.xticks(sizes, rotation=45)
+    plt.yscale("log")
+    plt.legend(fontsize="small")
+    plt.grid(True)
+    plt.tight_layout()
+    plt.savefig("../graficos/grafico_bulk.png")
+    plt.close()
+
+# CDF das latências por operação no maior N medido
+def plot_cdf(lat, fase, filename, skip_zero=False):
+    n_max = lat["N"].max()
+    plt.figure()
+    for estrutura in ["AVL", "RB", "SkipList"]:
+        if skip_zero and estrutura == "SkipList":
+            continue
+        dados = lat[(lat["Estrutura"] == estrutura) & (lat["Fase"] == fase) & (lat["N"] == n_max)]
+        plt.step(dados["Latencia(ns)"], dados["FracaoAcumulada"], where="post", label=estrutura)
+
+    for p in [0.5, 0.9, 0.99, 0.999]:
+        plt.axhline(p, color="gray", linestyle=":", linewidth=0.8)
+    plt.xlabel("Latencia (ns)")
+    plt.ylabel("Fracao acumulada")
+    plt.title(f"CDF {fase} (N = {n_max})")
+    plt.xscale("log")
+    plt.legend()
+    plt.grid(True)
+    plt.tight_layout()
+    plt.savefig(filename)
+    plt.close()
+
+if os.path.exists("../resultados/latencias.csv"):
+    lat = pd.read_csv("../resultados/latencias.csv")
+    plot_cdf(lat, "BuscaRemocao", "../graficos/grafico_cdf_busca_remocao.png")
+    plot_cdf(lat, "Balanceamento", "../graficos/grafico_cdf_balanceamento.png", skip_zero=True)
+    plot_cdf(lat, "Total", "../graficos/grafico_cdf_total.png")
+
 print("Gráficos gerados")
\ No newline at end of file